@@ -55,6 +55,9 @@ public:
   int      Q_reorganize;
   int      delta_reo;
 
+  int      Q_window;            // moving window, see box::move_window()
+  double   window_start;
+
   int      nsp;
 
   readfile rf;
@@ -71,9 +74,7 @@ class box {
 private:
   char errname[filename_size];
   input_box input;
-#ifdef LPIC_PARALLEL
   readfile rf;
-#endif
 
 public:
   box( parameter &p );
@@ -97,6 +98,13 @@ public:
   } reo;
 #endif
 
+  struct window_struct {
+  int    Q_window;
+  double start;           // time the window starts to move
+  } window;
+
+  void     move_window( domain &grid, double time, int time_step );
+
   struct rest_struct {
   int Q_restart_save;
   int delta_rest;
@@ -0,0 +1,66 @@
+/*
+   This file is part of LPIC++, a particle-in-cell code for
+   simulating the interaction of laser light with plasma.
+
+   Copyright (C) 1994-1997 Roland Lichters
+
+   LPIC++ is free software; you can redistribute it and/or
+   modify it under the terms of the GNU General Public License
+   as published by the Free Software Foundation; either version 2
+   of the License, or (at your option) any later version.
+
+   This program is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU General Public License for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with this program; if not, write to the Free Software
+   Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA 02111-1307, USA.
+*/
+
+#ifndef CELL_POOL_H
+#define CELL_POOL_H
+
+#include <common.h>
+#include <string.h>
+#include <error.h>
+#include <parameter.h>
+#include <cell.h>
+
+//////////////////////////////////////////////////////////////////////////////////////////
+//
+// slab allocator for the cells of a domain
+//
+// cells are allocated in slabs of at least CELL_SLAB cells and never returned to the
+// heap: cells removed from the domain in box::reorganize() are kept in a free list,
+// chained through cell::next, and handed out again to the next cells to be created;
+// the cells of a fresh slab are handed out in the order of their addresses, such that
+// a chain created in one go is contiguous in memory
+//
+//////////////////////////////////////////////////////////////////////////////////////////
+
+class cell_pool {
+
+ private:
+  char        errname[filename_size];
+
+  int         n_slabs, max_slabs;   // # of slabs in use and allocated
+  struct cell **slab;               // all slabs, see add_slab()
+  struct cell *free_cells;          // chain of unused cells
+  int         n_free;               // # of unused cells
+  int         n_cells;              // # of cells allocated in all slabs
+
+  void         add_slab( int n );
+
+ public:
+               cell_pool( parameter &p );
+  void           reserve( int n );
+  struct cell       *get( void );
+  void               put( struct cell *cell );
+  void               put( struct cell *first, struct cell *last, int n );
+  int              slabs( void ) { return n_slabs; }
+  int          allocated( void ) { return n_cells; }
+};
+
+#endif
@@ -39,6 +39,19 @@
 #undef SLOW
 #endif
 
+//#define LEGACY_PUSH 1      // -> propagate::particles(): five sweeps per cell instead of
+#undef LEGACY_PUSH           //    the fused single pass push, for validation only
+
+//#define LEGACY_DEPOSIT 1   // -> propagate::deposit_current(): the six case functions instead
+#undef LEGACY_DEPOSIT        //    of the straight-line current deposit, see deposit.h
+
+//#define CHECK_DEPOSIT 1    // -> propagate::check_deposit(): compare the straight-line deposit
+#undef CHECK_DEPOSIT         //    with the six cases bit for bit, propagate::check_simd():
+                             //    the simd blocks to a tolerance, for validation only
+
+//#define SINGLE_PARTICLES 1 // -> particle_store: positions and momenta in float,
+#undef SINGLE_PARTICLES      //    fields and currents remain double, see particle.h
+
 #define C    2.9979246e+8    // m/s    velocity of light in vacuum
 #define E    1.6021773e-19   // C      electron charge
 #define M    9.1093897e-31   // kg     electron mass
@@ -51,7 +64,34 @@
 #define PI   M_PI
 
 #define TINY 1e-10
-#define MASK 10              // -> propagate::mask_current()
+#define MASK 10              // -> propagate::fields()
+#ifdef SINGLE_PARTICLES
+#define PUSH_BLOCK 16        // -> propagate::push()
+#else
+#define PUSH_BLOCK 8
+#endif
+#define SORT_BINS  16        // -> propagate::sort_particles(): sub-cells per cell
+#define CELL_SLAB  1024      // -> cell_pool: min. # of cells allocated at once
+#define FIELD_ALIGN 8        // -> field_store: arrays start on multiples of 8 doubles
+#define MIN_WEIGHT 0.25      // -> propagate::resample(): min. weight of a split particle
+#define SUBCYCLE_SIGMAS 6    // -> input_domain: subcycled species need velocities
+                             //    below c/subcycle, up to 6 thermal velocities
+#define EDGE_CELLS 4         // -> propagate::edges(): cells at each domain edge pushed
+                             //    before the halo exchange, the deposition reaches 2 cells
+#define HALO_TAGS  8         // -> network::current_start(): tags of the overlapped halo
+                             //    exchange are HALO_TAGS * time step + kind of message
+
+#define BOUNDARY_MASK     0  // -> propagate::fields(): currents masked, particles reflected
+#define BOUNDARY_REINJECT 1  // -> propagate::reinject_particles(): currents not masked,
+                             //    particles mirrored back with their current deposited
+
+#define FIELDS_Y   1         // ey, bz, jy active  -> propagate::select_components()
+#define FIELDS_Z   2         // ez, by, jz active
+#define FIELDS_ALL 3
+
+#define SWEEP_ALL      0     // -> propagate::fields(): all cells left ... right,
+#define SWEEP_EDGES    1     //    left and right only, before the halo exchange,
+#define SWEEP_INTERIOR 2     //    or the cells in between, see propagate::loop()
 
 #define filename_size 100
 
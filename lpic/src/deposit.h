@@ -0,0 +1,584 @@
+/*
+   This file is part of LPIC++, a particle-in-cell code for
+   simulating the interaction of laser light with plasma.
+
+   Copyright (C) 1994-1997 Roland Lichters
+
+   LPIC++ is free software; you can redistribute it and/or
+   modify it under the terms of the GNU General Public License
+   as published by the Free Software Foundation; either version 2
+   of the License, or (at your option) any later version.
+
+   This program is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU General Public License for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with this program; if not, write to the Free Software
+   Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA 02111-1307, USA.
+*/
+
+//////////////////////////////////////////////////////////////////////////////////////////
+//
+// Villasenor-Buneman current deposit of a particle that has moved from x-dx to x
+// within one time step, see propagate::deposit_current()
+//
+// unified() is the straight-line form used by the push, cases() the original six
+// case functions, kept as the reference for check_deposit.C and LEGACY_DEPOSIT;
+// the current arrays and first_cell are held by reference, so that the kernels
+// follow field_store::set_cells()
+//
+//////////////////////////////////////////////////////////////////////////////////////////
+
+#ifndef DEPOSIT_H
+#define DEPOSIT_H
+
+#include <common.h>
+#include <error.h>
+#include <math.h>
+#include <cell.h>
+#include <particle.h>
+
+class current_deposit {
+
+ private:
+  char    errname[filename_size];
+
+  double  *&jx, *&jy, *&jz;       // current densities of the domain, see field.h
+  int     &first_cell;            // number of the cell with local index 0
+  double  dx, idx;                // grid spacing and its inverse
+
+  inline int index( struct cell *cell ) { return cell->number - first_cell; }
+
+  template <int FC>
+  inline void           left_one( struct cell *cell, particle_store *sp, int i );
+  template <int FC>
+  inline void      left_two_left( struct cell *cell, particle_store *sp, int i );
+  template <int FC>
+  inline void     left_two_right( struct cell *cell, particle_store *sp, int i );
+  template <int FC>
+  inline void          right_one( struct cell *cell, particle_store *sp, int i );
+  template <int FC>
+  inline void    right_two_right( struct cell *cell, particle_store *sp, int i );
+  template <int FC>
+  inline void     right_two_left( struct cell *cell, particle_store *sp, int i );
+
+ public:
+          current_deposit( double *&jx, double *&jy, double *&jz, int &first_cell,
+			   double dx, const char *errname );
+
+  template <int FC>
+  inline void              cases( struct cell *cell, particle_store *sp, int i );
+  template <int FC>
+  inline void            unified( struct cell *cell, particle_store *sp, int i );
+};
+
+//////////////////////////////////////////////////////////////////////////////////////////
+
+inline current_deposit::current_deposit( double *&x, double *&y, double *&z, int &first,
+					 double spacing, const char *name )
+  : jx(x), jy(y), jz(z), first_cell(first)
+{
+  strcpy( errname, name );
+
+  dx  = spacing;
+  idx = 1.0 / spacing;
+}
+
+//////////////////////////////////////////////////////////////////////////////////////////
+
+
+template <int FC>
+inline void current_deposit::cases( struct cell *cell, particle_store *sp, int i )
+// We distinguish six cases:
+// first, distinguish former position in the first or second half of the cell
+// second, distinguish one one-boundary move and two two-boundary moves
+// #-boundary move means contributions to # boundary currents Jx
+//
+// the currents are calculated from the continuity equation,
+// assuming rectangular particle shape and area weighting
+// J.Villasenor and O.Buneman, Comp. Phys. Comm. 69 (1992) 306-316
+{
+  static error_handler bob("current_deposit::cases",errname);
+
+  register double xm = sp->x[i] - sp->dx[i];               // before move
+  register double xp = sp->x[i];                          // afterwards
+  register double x0 = cell->x;                    // former left hand cell boundary
+
+  register double x0p05dx = x0 + 0.5*dx;
+  register double x0m05dx = x0 - 0.5*dx;
+  register double x0p15dx = x0 + 1.5*dx;
+
+  if ( xm < x0p05dx ) {                       // former position in first half of the cell
+
+    if ( xp < x0m05dx )    left_two_left<FC>( cell, sp, i );  // two boundary move to the left
+
+    else {
+      if ( xp >= x0p05dx ) left_two_right<FC>( cell, sp, i ); // two-boundary move to the right
+      else                 left_one<FC>( cell, sp, i );  // one boundary move
+    }
+  }
+
+  else {                                 // former position in the second half of the cell
+
+    if ( xp > x0p15dx )    right_two_right<FC>( cell, sp, i );// two boundary move to the right
+
+    else {
+      if ( xp <= x0p05dx && xp != xm )                   // two boundary move to the
+	                   right_two_left<FC>( cell, sp, i ); // left, unless resting on the
+                                                              // centre with eps = 0/0
+      else                 right_one<FC>( cell, sp, i );      // one boundary move
+    }
+  }
+}
+
+
+//////////////////////////////////////////////////////////////////////////////////////////
+
+
+template <int FC>
+inline void current_deposit::unified( struct cell *cell, particle_store *sp, int i )
+// the six cases of cases() in one straight line of arithmetic:
+// the case only selects the operands and the target cells, which the simd kernels
+// turn into blends, so that all moves are deposited there without branches
+//
+// the move touches at most the boundaries ia, ia+1 (jx) and the cells ia-1 ... ia+1
+// (jy, jz) relative to this cell, with
+//     ia = 0 (left_one), 1 (right_one),
+//         -1 (left_two_left), 0 (left_two_right, right_two_left), 1 (right_two_right)
+// the weights wa, wb go to the outer cells ia-1, ia+1 of a two-boundary move,
+// the remainder wm to cell ia; for a one-boundary move wa, wb go to ia-1, ia
+// and nothing to ia+1
+//
+// every weight is evaluated with the same operands in the same order as in the
+// six case functions, so the result is identical bit for bit, see check_deposit.C;
+// contributions of zero to the untouched boundary and cell do not change them
+{
+  static error_handler bob("current_deposit::unified",errname);
+
+  register double xm = sp->x[i] - sp->dx[i];               // before move
+  register double xp = sp->x[i];                          // afterwards
+  register double x0 = cell->x;                    // former left hand cell boundary
+  register double zn = sp->zn * sp->w[i];
+  register double g  = sp->igamma[i];
+
+  int lh    = xm < x0 + 0.5*dx;                    // former position in first half
+  int left  = lh ? ( xp <  x0 - 0.5*dx )                         // two-boundary moves,
+                 : ( xp <= x0 + 0.5*dx && xp != xm );            // not resting on the centre
+  int right = lh ? ( xp >= x0 + 0.5*dx ) : ( xp >  x0 + 1.5*dx );
+  int two   = left | right;
+  int ll    = lh & left;                           // left_two_left
+  int ia    = ( lh ? 0 : 1 ) - left;
+
+  double t   = ( xp + xm - 2.0*( x0 + ia*dx ) ) * idx;        // one-boundary moves
+  double ya  = left ? xp : xm;                                 // two-boundary moves
+  double yb  = left ? xm : xp;
+  double qa  = 0.5 - ( ya - x0 - ia*dx ) * idx;
+  double qb  = 0.5 + ( yb - x0 - (ia+1)*dx ) * idx;
+  double eps = ( xm - ( x0 + (ia+0.5)*dx ) ) / ( xm - xp );
+  double ea  = left ? 1.0-eps : eps;
+  double eb  = left ? eps : 1.0-eps;
+  double sz  = left ? -zn : zn;
+
+  double p1  = ll ? zn : 0.5;                                  // operands of the weights
+  double a2  = two ? ( ll ? g : ea ) : zn;
+  double a3  = two ? ( ll ? 0.5 : zn ) : ( ia ? g : 1.0-t );
+  double a4  = two ? ( ll ? ea : g ) : ( ia ? 1.0-t : g );
+  double a5  = two ? qa : 1.0;
+  double b2  = two ? ( ll ? g : eb ) : zn;
+  double b3  = two ? ( ll ? 0.5 : zn ) : ( ia ? g : 1.0+t );
+  double b4  = two ? ( ll ? eb : g ) : ( ia ? 1.0+t : g );
+  double b5  = two ? qb : 1.0;
+
+  double wa  = p1 * a2 * a3 * a4 * a5;
+  double wb  = p1 * b2 * b3 * b4 * b5;
+  double wm  = two ? zn * g - ( ll ? wb : wa ) - ( ll ? wa : wb ) : 0.0;
+
+  double ja  = ( two ? sz : zn ) * ( two ? qa : xp-xm ) * ( two ? 1.0 : idx );
+  double jb  = two ? sz * qb : 0.0;
+
+  double wl  = wa;                                 // cells ia-1, ia, ia+1
+  double wc  = two ? wm : wb;
+  double wr  = two ? wb : 0.0;
+
+  int ic = index( cell ) + ia;                    // local index of cell ia
+
+  jx[ic]   += ja;
+  jx[ic+1] += jb;
+  if ( FC & FIELDS_Y ) {
+    register double uy = sp->uy[i];
+    jy[ic-1] += wl * uy;
+    jy[ic]   += wc * uy;
+    jy[ic+1] += wr * uy;
+  }
+  if ( FC & FIELDS_Z ) {
+    register double uz = sp->uz[i];
+    jz[ic-1] += wl * uz;
+    jz[ic]   += wc * uz;
+    jz[ic+1] += wr * uz;
+  }
+}
+
+
+//////////////////////////////////////////////////////////////////////////////////////////
+
+
+template <int FC>
+inline void current_deposit::left_one( struct cell *cell, particle_store *sp, int i )
+{
+  static error_handler bob("current_deposit::left_one",errname);
+
+  int ic = index( cell );                          // local index of the cell
+
+  register double xm = sp->x[i] - sp->dx[i];               // before move
+  register double xp = sp->x[i];                          // afterwards
+  register double x0 = cell->x;                    // former left hand cell boundary
+  register double zn = sp->zn * sp->w[i];         // charge density of the particle
+
+  register double jx0  = zn * (xp-xm)*idx;
+  register double r_1  = 0.5 * zn * ( 1.0 - (xp+xm-2.0*x0)*idx ) * sp->igamma[i];
+  register double r0   = 0.5 * zn * ( 1.0 + (xp+xm-2.0*x0)*idx ) * sp->igamma[i];
+
+  register double jy_1 = r_1 * sp->uy[i];
+  register double jy0  = r0  * sp->uy[i];
+  register double jz_1 = r_1 * sp->uz[i];
+  register double jz0  = r0  * sp->uz[i];
+
+  jx[ic] += jx0;
+  if ( FC & FIELDS_Y ) {
+    jy[ic]   += jy0;
+    jy[ic-1] += jy_1;
+  }
+  if ( FC & FIELDS_Z ) {
+    jz[ic]   += jz0;
+    jz[ic-1] += jz_1;
+  }
+
+#ifdef DEBUG
+  r_1 /= sp->igamma[i];
+  r0  /= sp->igamma[i];
+
+  if ( fabs(r_1+r0 - zn) > TINY || fabs(r_1) > fabs(zn)+TINY
+                                       || fabs(r0) > fabs(zn)+TINY ) {
+    bob.message( "r_1      =", r_1 );
+    bob.message( "r0       =", r0 );
+    bob.message( "part->zn =", zn );
+    bob.message( "dif      =", fabs(r_1+r0 - zn) );
+    bob.message( "part->N  =", sp->number[i] );
+    bob.error( "density splitting wrong!" );
+  }
+#endif
+}
+
+//////////////////////////////////////////////////////////////////////////////////////////
+
+
+template <int FC>
+inline void current_deposit::left_two_left(  struct cell *cell, particle_store *sp, int i )
+{
+  static error_handler bob("current_deposit::left_two_left",errname);
+
+  int ic = index( cell );                          // local index of the cell
+
+  register double xm = sp->x[i] - sp->dx[i];              // before move
+  register double xp = sp->x[i];                         // afterwards
+  register double x0 = cell->x;                   // former left hand cell boundary
+  register double zn = sp->zn * sp->w[i];        // charge density of the particle
+  register double jx_1 = - zn * ( 0.5 - (xp-x0+dx)*idx );
+  register double jx0  = - zn * ( 0.5 + (xm-x0)*idx );
+
+  register double eps  = ( xm - (x0-0.5*dx) ) / ( xm - xp );
+  register double r_2  = zn * sp->igamma[i] * 0.5*(1.0-eps) * ( 0.5 - (xp-x0+dx)*idx );
+  register double r0   = zn * sp->igamma[i] * 0.5*eps * ( 0.5 + (xm-x0)*idx );
+  register double r_1  = zn * sp->igamma[i] - r0 - r_2;
+
+  register double jy_2 = r_2 * sp->uy[i];
+  register double jy_1 = r_1 * sp->uy[i];
+  register double jy0  = r0  * sp->uy[i];
+  register double jz_2 = r_2 * sp->uz[i];
+  register double jz_1 = r_1 * sp->uz[i];
+  register double jz0  = r0  * sp->uz[i];
+
+  jx[ic]   += jx0;
+  jx[ic-1] += jx_1;
+  if ( FC & FIELDS_Y ) {
+    jy[ic]   += jy0;
+    jy[ic-1] += jy_1;
+    jy[ic-2] += jy_2;
+  }
+  if ( FC & FIELDS_Z ) {
+    jz[ic]   += jz0;
+    jz[ic-1] += jz_1;
+    jz[ic-2] += jz_2;
+  }
+
+#ifdef DEBUG
+  r_2 /= sp->igamma[i];
+  r_1 /= sp->igamma[i];
+  r0  /= sp->igamma[i];
+
+  if ( fabs(r_2+r_1+r0 - zn) > TINY || fabs(r_2) > fabs(zn)+TINY ||
+                fabs(r_1) > fabs(zn)+TINY || fabs(r0) > fabs(zn)+TINY )   {
+    bob.message( "r_2      =", r_2 );
+    bob.message( "r_1      =", r_1 );
+    bob.message( "r0       =", r0 );
+    bob.message( "dif      =", fabs(r_2+r_1+r0 - zn) );
+    bob.message( "part->zn =", zn );
+    bob.message( "part->N  =", sp->number[i] );
+    bob.error( "density splitting wrong!" );
+  }
+  if ( eps < 0 || eps > 1 )
+    bob.error( "eps!" );
+#endif
+}
+
+
+//////////////////////////////////////////////////////////////////////////////////////////
+
+
+template <int FC>
+inline void current_deposit::left_two_right( struct cell *cell, particle_store *sp, int i )
+{
+  static error_handler bob("current_deposit::left_two_right",errname);
+
+  int ic = index( cell );                          // local index of the cell
+
+  register double xm = sp->x[i] - sp->dx[i];              // before move
+  register double xp = sp->x[i];                         // afterwards
+  register double x0 = cell->x;                   // former left hand cell boundary
+  register double zn = sp->zn * sp->w[i];        // charge density of the particle
+  register double jx0 = zn * ( 0.5 - (xm-x0)*idx );
+  register double jx1 = zn * ( 0.5 + (xp-x0-dx)*idx );
+
+  register double eps = ( x0 + 0.5*dx - xm ) / ( xp - xm );
+  register double r_1 = 0.5*eps * zn * sp->igamma[i] * ( 0.5 - (xm-x0)*idx );
+  register double r1  = 0.5*(1.0-eps) * zn * sp->igamma[i] * ( 0.5 + (xp-x0-dx)*idx );
+  register double r0  = zn * sp->igamma[i] - r_1 - r1;
+
+  register double jy_1 = r_1 * sp->uy[i];
+  register double jy0  = r0  * sp->uy[i];
+  register double jy1  = r1  * sp->uy[i];
+
+  register double jz_1 = r_1 * sp->uz[i];
+  register double jz0  = r0  * sp->uz[i];
+  register double jz1  = r1  * sp->uz[i];
+
+  jx[ic]   += jx0;
+  jx[ic+1] += jx1;
+  if ( FC & FIELDS_Y ) {
+    jy[ic-1] += jy_1;
+    jy[ic]   += jy0;
+    jy[ic+1] += jy1;
+  }
+  if ( FC & FIELDS_Z ) {
+    jz[ic-1] += jz_1;
+    jz[ic]   += jz0;
+    jz[ic+1] += jz1;
+  }
+
+#ifdef DEBUG
+  r_1 /= sp->igamma[i];
+  r0  /= sp->igamma[i];
+  r1  /= sp->igamma[i];
+
+  if ( fabs(r_1+r0+r1-zn)>1e-10 || fabs(r_1) > fabs(zn)+TINY ||
+            fabs(r0) > fabs(zn)+TINY || fabs(r1) > fabs(zn)+TINY )   {
+    bob.message( "r_1      =", r_1 );
+    bob.message( "r0       =", r0 );
+    bob.message( "r1       =", r1 );
+    bob.message( "part->zn =", zn );
+    bob.message( "dif      =", fabs(r_1+r0+r1-zn) );
+    bob.message( "part->N  =", sp->number[i] );
+    bob.error( "density splitting wrong!" );
+  }
+  if ( eps < 0 || eps > 1 )
+    bob.error( "eps!" );
+#endif
+}
+
+
+//////////////////////////////////////////////////////////////////////////////////////////
+
+
+template <int FC>
+inline void current_deposit::right_one( struct cell *cell, particle_store *sp, int i )
+{
+  static error_handler bob("current_deposit::right_one",errname);
+
+  int ic = index( cell );                          // local index of the cell
+
+  register double xm = sp->x[i] - sp->dx[i];              // before move
+  register double xp = sp->x[i];                         // afterwards
+  register double x0 = cell->x;                   // former left hand cell boundary
+  register double zn = sp->zn * sp->w[i];        // charge density of the particle
+  register double jx1 = zn * (xp-xm)*idx;
+
+  register double r0  = 0.5 * zn * sp->igamma[i] * ( 1.0 - (xp+xm-2.0*(x0+dx))*idx );
+  register double r1  = 0.5 * zn * sp->igamma[i] * ( 1.0 + (xp+xm-2.0*(x0+dx))*idx );
+
+  register double jy0 = r0 * sp->uy[i];
+  register double jy1 = r1 * sp->uy[i];
+
+  register double jz0 = r0 * sp->uz[i];
+  register double jz1 = r1 * sp->uz[i];
+
+  jx[ic+1] += jx1;
+  if ( FC & FIELDS_Y ) {
+    jy[ic]   += jy0;
+    jy[ic+1] += jy1;
+  }
+  if ( FC & FIELDS_Z ) {
+    jz[ic]   += jz0;
+    jz[ic+1] += jz1;
+  }
+
+#ifdef DEBUG
+  r0 /= sp->igamma[i];
+  r1 /= sp->igamma[i];
+
+  if ( fabs(r0+r1 - zn) > TINY || fabs(r0) > fabs(zn)+TINY ||
+                                         fabs(r1) > fabs(zn)+TINY )  {
+    bob.message( "r0       =", r0 );
+    bob.message( "r1       =", r1 );
+    bob.message( "part->zn =", zn );
+    bob.message( "dif      =", fabs(r0+r1 - zn) );
+    bob.message( "part->N  =", sp->number[i] );
+    bob.error( "density splitting wrong!" );
+  }
+#endif
+}
+
+
+//////////////////////////////////////////////////////////////////////////////////////////
+
+
+template <int FC>
+inline void current_deposit::right_two_right( struct cell *cell, particle_store *sp, int i )
+{
+  static error_handler bob("current_deposit::right_two_right",errname);
+
+  int ic = index( cell );                          // local index of the cell
+
+  register double xm = sp->x[i] - sp->dx[i];              // before move
+  register double xp = sp->x[i];                         // afterwards
+  register double x0 = cell->x;                   // former left hand cell boundary
+  register double zn = sp->zn * sp->w[i];        // charge density of the particle
+  register double jx1 = zn * ( 0.5 - (xm-x0-dx)*idx );
+  register double jx2 = zn * ( 0.5 + (xp-x0-2.0*dx)*idx );
+
+  register double eps = (x0+1.5*dx - xm) / (xp - xm);
+  register double r0  = 0.5*eps * zn * sp->igamma[i] * ( 0.5 - (xm-x0-dx)*idx );
+  register double r2  = 0.5*(1.0-eps) * zn * sp->igamma[i] * ( 0.5 + (xp-x0-2.0*dx)*idx );
+  register double r1  = zn * sp->igamma[i] - r0 - r2;
+
+  register double jy0 = r0 * sp->uy[i];
+  register double jy1 = r1 * sp->uy[i];
+  register double jy2 = r2 * sp->uy[i];
+
+  register double jz0 = r0 * sp->uz[i];
+  register double jz1 = r1 * sp->uz[i];
+  register double jz2 = r2 * sp->uz[i];
+
+  jx[ic+1] += jx1;
+  jx[ic+2] += jx2;
+  if ( FC & FIELDS_Y ) {
+    jy[ic]   += jy0;
+    jy[ic+1] += jy1;
+    jy[ic+2] += jy2;
+  }
+  if ( FC & FIELDS_Z ) {
+    jz[ic]   += jz0;
+    jz[ic+1] += jz1;
+    jz[ic+2] += jz2;
+  }
+
+#ifdef DEBUG
+  r0 /= sp->igamma[i];
+  r1 /= sp->igamma[i];
+  r2 /= sp->igamma[i];
+
+  if ( fabs(r0+r1+r2 - zn) > TINY || fabs(r0) > fabs(zn)+TINY ||
+               fabs(r1) > fabs(zn)+TINY || fabs(r2) > fabs(zn)+TINY )  {
+    bob.message( "r0       =", r0 );
+    bob.message( "r1       =", r1 );
+    bob.message( "r2       =", r2 );
+    bob.message( "part->zn =", zn );
+    bob.message( "dif      =", fabs(r0+r1+r2 - zn) );
+    bob.message( "part->N  =", sp->number[i] );
+    bob.error( "density splitting wrong!" );
+  }
+  if ( eps < 0 || eps > 1 )
+    bob.error( "eps!" );
+#endif
+}
+
+
+//////////////////////////////////////////////////////////////////////////////////////////
+
+
+template <int FC>
+inline void current_deposit::right_two_left( struct cell *cell, particle_store *sp, int i )
+{
+  static error_handler bob("current_deposit::right_two_left",errname);
+
+  int ic = index( cell );                          // local index of the cell
+
+  register double xm = sp->x[i] - sp->dx[i];               // before move
+  register double xp = sp->x[i];                          // afterwards
+  register double x0 = cell->x;                    // former left hand cell boundary
+  register double zn = sp->zn * sp->w[i];         // charge density of the particle
+  register double jx0  = - zn * ( 0.5 - (xp-x0)*idx );
+  register double jx1  = - zn * ( 0.5 + (xm-x0-dx)*idx );
+
+  register double eps  = ( xm - (x0+0.5*dx) ) / ( xm - xp );
+  register double r_1  = 0.5*(1.0-eps) * zn * sp->igamma[i] * ( 0.5 - (xp-x0)*idx );
+  register double r1   = 0.5*eps * zn * sp->igamma[i] * ( 0.5 + (xm-x0-dx)*idx );
+  register double r0   = zn * sp->igamma[i] - r_1 - r1;
+
+  register double jy_1 = r_1 * sp->uy[i];
+  register double jy0  = r0  * sp->uy[i];
+  register double jy1  = r1  * sp->uy[i];
+
+  register double jz_1 = r_1 * sp->uz[i];
+  register double jz0  = r0  * sp->uz[i];
+  register double jz1  = r1  * sp->uz[i];
+
+  jx[ic]   += jx0;
+  jx[ic+1] += jx1;
+  if ( FC & FIELDS_Y ) {
+    jy[ic-1] += jy_1;
+    jy[ic]   += jy0;
+    jy[ic+1] += jy1;
+  }
+  if ( FC & FIELDS_Z ) {
+    jz[ic-1] += jz_1;
+    jz[ic]   += jz0;
+    jz[ic+1] += jz1;
+  }
+
+#ifdef DEBUG
+  r_1 /= sp->igamma[i];
+  r0  /= sp->igamma[i];
+  r1  /= sp->igamma[i];
+
+  if ( fabs(r_1+r0+r1 - zn) > TINY || fabs(r_1) > fabs(zn)+TINY ||
+               fabs(r0) > fabs(zn)+TINY  || fabs(r1) > fabs(zn)+TINY )   {
+    bob.message( " r_1      =", r_1 );
+    bob.message( " r0       =", r0 );
+    bob.message( " r1       =", r1 );
+    bob.message( " part->zn =", zn );
+    bob.message( " dif      =", fabs(r_1+r0+r1 - zn) );
+    bob.message( "part->N  =", sp->number[i] );
+    bob.error( "density splitting wrong!" );
+  }
+
+  if ( eps < 0 || eps > 1 )
+    bob.error( "eps!" );
+#endif
+}
+
+
+//////////////////////////////////////////////////////////////////////////////////////////
+
+#endif
@@ -79,6 +79,9 @@ public:
   void             out( double time, domain* grid, parameter &p );
   void           count( void );
   int     write_window( int time_steps, diagnostic_stepper *stepper );
+  int       will_write( int time_steps, diagnostic_stepper *stepper );
+  int    needs_density( void );
+  int    needs_current( void );
 
   int     public_time_steps;
   int     time_out_count;
@@ -38,6 +38,7 @@ private:
 
 public:
   stepper_param stepper;
+  char          reference[filename_size];   // output path of a run to compare with
   int           Q_restart;
   char          restart_file[filename_size];
 
@@ -52,6 +53,14 @@ private:
   readfile     rf;
   input_energy input;
 
+  char         *drift_name;      // drift of the total energy in full precision
+  int          n_ref, i_ref;     // drift of the reference run, see read_reference()
+  double       *ref_time, *ref_drift;
+  double       max_diff;
+
+  void read_reference ( parameter &p );
+  void write_drift    ( double time );
+
 public:
   diagnostic_stepper stepper;
 
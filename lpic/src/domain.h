@@ -30,7 +30,10 @@
 #include <math.h>
 #include <error.h>
 #include <cell.h>
+#include <cell_pool.h>
 #include <particle.h>
+#include <field.h>
+#include <rng.h>
 #include <parameter.h>
 #include <readfile.h>
 
@@ -53,10 +56,13 @@ public:
 
   double   n_ion_over_nc;       // plasma density
   double   n_el_over_nc;
+  int      seed;                // random seed of the thermal velocities, see rng.h
 
   int      nsp;                 // particles
   int      *ppc;
+  int      *ppc_max, *ppc_min;  // resampling limits, see propagate::resample()
   int      *fix;
+  int      *subcycle;           // pushes every subcycle time steps, see propagate::subcycle()
   double   *z, *zmax, *m;
   double   *vtherm;
 
@@ -79,21 +85,26 @@ class domain {
   int          n_domains;
   char         path[filename_size];
   input_domain input;
+  cell_pool    pool;      // all cells of this domain, see cell_pool.h
 
   void restart_configuration( void );
   void        set_boundaries( void );
   void           chain_cells( void );
   void            init_cells( void );
+  void          init_species( parameter &p );
   void       chain_particles( void );
   void        init_particles( void );
-  double        gauss_rand48( void );
-  double    exponential_rand( double ); // ## exponential velocity distribution
+  void      thermal_velocity( int species, int i );
+  double     density_profile( int number );
+  void                inject( struct cell *cell );
+  double    exponential_rand( rng_stream &r, double tm ); // ## exponential distribution
 
 public:
 
   int         n_left;     // cell number at the left boundary
   int         n_right;    // cell number at the right boundary
   int         n_cells;    // number of cells in this domain
+  int         n_moved;    // number of cells the window has moved, see move_window()
 
   double dx;              // cell width
 
@@ -105,13 +116,24 @@ public:
   struct cell *Rbuf;      //      right buffer      right of right
   struct cell *dummy;     // definitely the last one
 
+  struct cell *occupied;      // first cell holding particles, see occupied_cells()
+  struct cell *occupied_end;  // cell behind the last one holding particles
+
   int n_el;               // # of electrons
   int n_ion;              // # of ions
   int n_part;             // total # particles
+  int *last_number;       // highest particle number of each species, see inject()
+
+  int nsp;                // # of particle species
+  particle_store *store;  // particles of each species, sorted by cell
+  field_store field;      // fields, currents and densities of the cells Lbuf ... dummy
 
                     domain( parameter &p );
   void     count_particles( void );
+  void      sort_particles( void );
+  void      occupied_cells( void );
   void               check( void );
+  void         move_window( void );
 
   void         reo_to_prev( int request_to_prev, int *cells_to_prev, int *parts_to_prev );
   void         reo_to_next( int request_to_next, int *cells_to_next, int *parts_to_next );
@@ -0,0 +1,74 @@
+/*
+   This file is part of LPIC++, a particle-in-cell code for
+   simulating the interaction of laser light with plasma.
+
+   Copyright (C) 1994-1997 Roland Lichters
+
+   LPIC++ is free software; you can redistribute it and/or
+   modify it under the terms of the GNU General Public License
+   as published by the Free Software Foundation; either version 2
+   of the License, or (at your option) any later version.
+
+   This program is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU General Public License for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with this program; if not, write to the Free Software
+   Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA 02111-1307, USA.
+*/
+
+#ifndef FIELD_H
+#define FIELD_H
+
+#include <common.h>
+#include <string.h>
+#include <error.h>
+#include <parameter.h>
+#include <cell.h>
+
+//////////////////////////////////////////////////////////////////////////////////////////
+//
+// fields, currents and densities of all cells of one domain, stored as a structure
+// of arrays
+//
+// the values of the cell with number c are found at the local cell index
+// k = c - first_cell, which runs from 0 (Lbuf) over the buffer cells lbuf, left ...
+// right, rbuf to n_cells-1 (Rbuf and dummy), see domain::sort_particles();
+// each array starts on a multiple of FIELD_ALIGN doubles
+//
+//////////////////////////////////////////////////////////////////////////////////////////
+
+class field_store {
+
+ private:
+  char    errname[filename_size];
+
+  int     capacity;               // allocated length of each array
+  double  *block;                 // memory of all arrays
+
+ public:
+  int     first_cell;             // number of the cell with local index 0
+  int     n_cells;                // # cells including all buffers
+
+  double  *charge;                // charge density in units e*n_c
+  double  *jx, *jy, *jz;          // current density in units e*n_c*c
+  double  *ex, *ey, *ez;          // electric fields in units m*omega*c/e
+  double  *bx, *by, *bz;          // magnetic fields in units m*omega/e
+  double  *fp, *fm, *gp, *gm;     //
+  double  *fp_next, *fm_next;     // the next time step of fp, fm, gp, gm, written by
+  double  *gp_next, *gm_next;     // propagate::fields(), which exchanges the pointers
+  double  *jmask;                 // factors of the currents near the box boundaries
+  double  *dens[2];               // densities for each species in units n_c
+  double  *ex_sum[2], *ey_sum[2]; // fields summed over the time steps between two pushes
+  double  *ez_sum[2], *by_sum[2]; // of a subcycled species,
+  double  *bz_sum[2];             // see propagate::subcycle()
+
+          field_store( parameter &p );
+  void      set_cells( int first_cell, int n_cells );
+
+  inline int index( struct cell *cell ) { return cell->number - first_cell; }
+};
+
+#endif
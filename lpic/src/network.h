@@ -22,12 +22,17 @@
 #include <config.h>
 
 #ifdef LPIC_PARALLEL
-#ifdef LPIC_PVM
 
 #ifndef NETWORK_H
 #define NETWORK_H
 
+#ifdef LPIC_PVM
 #include <pvm3.h>
+#include <sys/time.h>
+#endif
+#ifdef LPIC_MPI
+#include <mpi.h>
+#endif
 
 #include <common.h>
 #include <parameter.h>
@@ -46,9 +51,67 @@ class network {
   int tid;        // my_tid()
   int tid_prev;   // this task was spawned by 'prev'
   int tid_next;   // this task will have spawned 'next'
+                  // with MPI these are ranks, -1 if there is no such domain
 
   char errname[filename_size];
 
+  // the overlapped halo exchange, see current_start(): kinds of messages,
+  // the particles take two tags
+  enum { HALO_CURRENT, HALO_COPY, HALO_PARTICLES, HALO_DENSITY = 4, HALO_FIELD,
+	 HALO_AGGREGATE };
+
+  int    aggregate;               // one message per neighbour, see halo()
+
+  int    sent_prev, sent_next;    // particles sent by particles_start()
+  double posted;                  // wall clock time the halo messages were sent
+  double overlapped;              // time between sending and completing them
+  double waited;                  // time blocked in recv()
+  int    n_recv, n_ready;         // # of messages recieved, # found already there
+
+  double             wall( void );
+  int               probe( int ptid, int msgtag );
+
+  void      aggregate_start( int time_step, domain* grid, int moved, int deposited );
+  void     aggregate_finish( int time_step, domain* grid, int deposited );
+  void            halo_send( domain* grid, struct cell* cell, struct cell* buffer,
+			     int ptid, int msgtag, int deposited, int *count );
+  void             halo_get( domain* grid, int ptid, int msgtag, int deposited,
+			     int *el_count, int *ion_count );
+
+#ifdef LPIC_PVM
+  char *stage;                    // particle data of pkreserve() and upkreserve()
+  int  stage_size, staged;
+
+  void      stage_bytes( int bytes );
+  void            flush( void );
+#endif
+
+#ifdef LPIC_MPI
+  int  tag_ub;                    // message tags are taken modulo MPI_TAG_UB
+
+  char *send_buf, *recv_buf;      // message being packed and message being unpacked
+  int  send_size, send_pos;
+  int  recv_size, recv_pos, recv_len;
+
+  int         n_pending, max_pending;   // sends not yet completed
+  MPI_Request *pending_request;
+  char        **pending_buf;
+
+  void             pack( const void *data, int bytes );
+  void           unpack( void *data, int bytes );
+  void   complete_sends( int wait );
+#endif
+
+  void         initsend( void );   // pvm style message passing, see network.C
+  void            pkint( int *data, int n );
+  void         pkdouble( double *data, int n );
+  char       *pkreserve( int bytes );  // room in the message, written by the caller
+  void             send( int ptid, int msgtag );
+  void             recv( int ptid, int msgtag );
+  void           upkint( int *data, int n );
+  void        upkdouble( double *data, int n );
+  char      *upkreserve( int bytes );  // the next bytes of the message, read in place
+
  public:
 
   network( parameter &p );
@@ -56,26 +119,43 @@ class network {
   void      start_next_task( parameter &p );
 
   void                field( int time_step, domain* grid );
-  void        field_get_cpy( struct cell*, int ptid, int time_step );
-  void       field_send_cpy( struct cell*, int ptid, int time_step );
+  void        field_get_cpy( domain* grid, struct cell*, int ptid, int time_step );
+  void       field_send_cpy( domain* grid, struct cell*, int ptid, int time_step );
   void            particles( int time_step, domain* grid );
-  void        particles_get( struct cell* cell, int ptid, int time_step,
+  void        particles_get( domain* grid, struct cell* cell, int ptid, int time_step,
 			     int *el_count, int *ion_count );
-  void       particles_send( struct cell* cell, int ptid, int time_step,
+  void       particles_send( domain* grid, struct cell* cell, int ptid, int time_step,
 			     int *el_count, int *ion_count );
   void              current( int time_step, domain* grid );
-  void          current_get( struct cell* cell, int ptid, int time_step );
-  void         current_send( struct cell* cell, int ptid, int time_step );
-  void      current_get_cpy( struct cell* cell, int ptid, int time_step );
-  void     current_send_cpy( struct cell* cell, int ptid, int time_step );
+  void          current_get( domain* grid, struct cell* cell, int ptid, int time_step );
+  void         current_send( domain* grid, struct cell* cell, int ptid, int time_step );
+  void      current_get_cpy( domain* grid, struct cell* cell, int ptid, int time_step );
+  void     current_send_cpy( domain* grid, struct cell* cell, int ptid, int time_step );
   void              density( int time_step, domain* grid );
-  void          density_get( struct cell* cell, int ptid, int time_step );
-  void         density_send( struct cell* cell, int ptid, int time_step );
+  void               window( int time_step, domain* grid );
+  void          density_get( domain* grid, struct cell* cell, int ptid, int time_step );
+  void         density_send( domain* grid, struct cell* cell, int ptid, int time_step );
+
+  void                 halo( int time_step, domain* grid, int deposited );
+  void           halo_start( int time_step, domain* grid, int deposited );
+  void          halo_finish( int time_step, domain* grid, int deposited );
+
+  void        current_start( int time_step, domain* grid );
+  void       current_finish( int time_step, domain* grid );
+  void      particles_start( int time_step, domain* grid );
+  void     particles_finish( int time_step, domain* grid );
+  void       particles_send_leaving( domain* grid, struct cell* cell, struct cell* buffer,
+				     int ptid, int msgtag, int *count );
+  void       particles_drop( domain* grid, struct cell* buffer, int count );
+  void        density_start( int time_step, domain* grid );
+  void       density_finish( int time_step, domain* grid );
+  void          field_start( int time_step, domain* grid );
+  void         field_finish( int time_step, domain* grid );
 
   void            current_1( int time_step, domain* grid );
   void            current_2( int time_step, domain* grid );
-  void       current_get_12( struct cell* cell, int ptid, int time_step );
-  void      current_send_12( struct cell* cell, int ptid, int time_step );
+  void       current_get_12( domain* grid, struct cell* cell, int ptid, int time_step );
+  void      current_send_12( domain* grid, struct cell* cell, int ptid, int time_step );
 
   void   get_part_numbers_from_prev( int* number, int n );
   void    send_part_numbers_to_next( int* number, int n );
@@ -87,27 +167,30 @@ class network {
   void                reo_from_prev( int *cells_from_prev, int *parts_from_prev );
   void                reo_from_next( int *cells_from_next, int *parts_from_next );
   void reo_recieve_from_prev_and_unpack( int cells_from_prev, int parts_from_prev,
-                                     struct cell* firstcell,
+                                     domain* grid,
 				     int *el_count, int *ion_count );
   void reo_recieve_from_next_and_unpack( int cells_from_next, int parts_from_next,
-                                     struct cell* lastcell,
+                                     domain* grid,
 				     int *el_count, int *ion_count );
   void                  reo_to_prev( int cells_from_prev, int parts_from_prev );
   void                  reo_to_next( int cells_to_next, int parts_to_next );
   void    reo_pack_and_send_to_prev( int cells_to_prev, int parts_to_prev,
-                                     struct cell* firstcell );
+                                     domain* grid );
   void    reo_pack_and_send_to_next( int cells_to_next, int parts_to_next,
-                                     struct cell* lastcell );
+                                     domain* grid );
 
-  void                pack_particle( struct particle *part );
-  void              unpack_particle( struct particle *part );
-  void                    pack_cell( struct cell *cell );
-  void                  unpack_cell( struct cell *cell );
-  void          pack_cell_as_buffer( struct cell *cell );
+  int                pack_particles( domain* grid, struct cell* cell, struct cell* buffer );
+  int              unpack_particles( domain* grid, struct cell* cell,
+				     int *el_count, int *ion_count );
+  void                pack_particle( particle_store *sp, int i );
+  int               unpack_particle( domain* grid, struct cell *cell );
+  void                    pack_cell( domain* grid, struct cell *cell );
+  void                  unpack_cell( domain* grid, struct cell *cell );
+  void          pack_cell_as_buffer( domain* grid, struct cell *cell );
 
+  void               report( void );
   void             end_task( void );
 };
 
 #endif
 #endif
-#endif
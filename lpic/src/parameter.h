@@ -30,6 +30,12 @@
 #ifndef PARAMETER_H
 #define PARAMETER_H
 
+#include <config.h>
+
+#ifdef LPIC_MPI
+#include <mpi.h>
+#endif
+
 #include <common.h>
 #include <error.h>
 #include <fstream>
@@ -53,6 +59,7 @@ public:
   char      *input_file_name;        // command line input or default value
   int       domain_number;           // command line input or default value
   int       n_domains;               // namelist input
+  int       aggregate;               // namelist input, see network::halo()
   char      *path;                   // namelist input
   char      *errname;                // file name for output of errors and comments
   char      *outname;                // file name for output of input
@@ -22,26 +22,142 @@
 #ifndef PARTICLE_H
 #define PARTICLE_H
 
-#include <cell.h>
-
-struct particle {
-
-  int             number;        // number of this particle
-  int             species;       // particle species, 0=electron, 1=ion
-  struct cell     *cell;         // pointer to the cell this particle belongs to
-  struct particle *prev;         // pointer to the previous particle in this cell
-  struct particle *next;         // pointer to the next particle in this cell
-
-  int    fix;                    // fixed species? 0->no, 1->yes
-  double z;                      // charge of the micro particle in units of e
-  double m;                      // mass of the micro particle in units of m_e
-  double zm;                     // specific charge, z/m
-  double x, dx;                  // position and shift within one timestep
-  double igamma;                 // inverse gamma factor
-  double ux, uy, uz;             // gamma * velocity
-  double n;                      // particle density in units of n_c
-  double zn;                     // contribution of the particle to the charge density
-                                 // in units of n_c ( = z * n )
+#include <common.h>
+#include <string.h>
+#include <error.h>
+#include <parameter.h>
+
+//////////////////////////////////////////////////////////////////////////////////////////
+//
+// floating point type of the particle state, see SINGLE_PARTICLES in common.h
+//
+// in single precision the displacement dx stored by the push is the one actually
+// realized in float, x(new) - x(old), such that the current deposition still
+// conserves charge exactly; the arithmetic of the push is done in double
+//
+// x is the absolute position, not the offset within the cell: in float its resolution
+// is the ulp of x, which grows with the length of the box (about 4e-6 wavelengths at
+// x = 60), and particles come to rest exactly on the cell centres rounded to float,
+// see the single precision simd kernels in simd.C
+//
+//////////////////////////////////////////////////////////////////////////////////////////
+
+#ifdef SINGLE_PARTICLES
+typedef float  particle_real;
+#else
+typedef double particle_real;
+#endif
+
+#define PARTICLE_BYTES ( 2 * sizeof(int) + 7 * sizeof(particle_real) )
+
+//////////////////////////////////////////////////////////////////////////////////////////
+//
+// all macro particles of one species in one domain, stored as a structure of arrays
+//
+// particles are kept sorted by cell: the particles of the cell with number c are
+// found at the indices  begin(c) <= i < end(c)
+// the local cell index  c - first_cell  runs from 0 (Lbuf) to n_cells-1 (Rbuf)
+//
+//////////////////////////////////////////////////////////////////////////////////////////
+
+class particle_store {
+
+ private:
+  char    errname[filename_size];
+
+  int     capacity;               // allocated length of the particle arrays
+  int     cell_capacity;          // allocated length of start[]
+  int     tmp_capacity;           // allocated length of the sort buffers
+  int     bin_capacity;           // allocated length of bin_start[]
+
+  int     *tmp_int;               // buffers for the counting sort
+  particle_real *tmp_real;
+  int     *tmp_index;
+  int     *bin_start;             // first index of each sub-cell, see sort_positions()
+
+  int     *to_left;               // # particles leaving cell k to the left, see migrate()
+  int     *to_right;              // # particles leaving cell k to the right
+
+  void    grow( int n );
+  void    reserve_buffers( void );
+  void    scatter( void );
+  void    move( int from, int to, int n );
+  void    partition( int k );
+  void    reverse( int first, int last );
+  inline void exchange( int i, int j );
+
+ public:
+  int     species;                // particle species, 0=electron, 1=ion
+  int     fix;                    // fixed species? 0->no, 1->yes
+  int     subcycle;               // pushed every subcycle time steps, see propagate::subcycle()
+  double  vtherm;                 // thermal velocity of the loaded particles
+  double  z;                      // charge of the micro particle in units of e
+  double  m;                      // mass of the micro particle in units of m_e
+  double  zm;                     // specific charge, z/m
+  double  n;                      // particle density in units of n_c
+  double  zn;                     // contribution of a particle of weight 1 to the charge
+                                  // density in units of n_c ( = z * n )
+  int     ppc_max;                // merge particles in cells with more, 0: never
+  int     ppc_min;                // split particles in cells with less, 0: never
+
+  int     np;                     // # particles of this species
+  int     first_cell;             // number of the cell with local index 0
+  int     n_cells;                // # cells including all buffers
+  int     *start;                 // start[k] = index of the first particle in cell k
+
+  double  *rho, *jy, *jz;         // fixed species and subcycled species between their pushes:
+  int     rho_valid;              // cached charge density and currents of cell k,
+                                  // see propagate::frozen_species()
+
+  int     *number;                // number of this particle
+  int     *cell;                  // number of the cell this particle belongs to
+  particle_real *x, *dx;         // position and shift within one timestep
+  particle_real *igamma;          // inverse gamma factor
+  particle_real *ux, *uy, *uz;    // gamma * velocity
+  particle_real *w;               // weight, 1 unless resampled, see propagate::resample()
+
+          particle_store( void );
+  void              init( parameter &p, int species, int capacity );
+  void           reserve( int n );
+  void         set_cells( int first_cell, int n_cells );
+  int                add( int cell_number );
+  void              sort( void );
+  void    sort_positions( double width, int bins );
+  void             erase( int first, int last );
+  int             insert( int cell_number, int n );
+  void           migrate( int n, int *index );
+  void           compact( void );
+  int            leaving( int cell_number, int to_cell );
+  void              pack( int cell_number, int to_cell, int n, char *buffer );
+  int             append( int n, const char *buffer, int cell_number );
+
+  inline int   begin( int c ) { return start[ c - first_cell ];     }
+  inline int     end( int c ) { return start[ c - first_cell + 1 ]; }
+  inline int   count( int c ) { return end(c) - begin(c);          }
+
+  // the occupied cells of this species, valid for np > 0: as the particles are kept
+  // sorted by cell, migrate() and sort() maintain this range without extra work
+  inline int first_occupied( void ) { return cell[0];    }
+  inline int  last_occupied( void ) { return cell[np-1]; }
 };
 
+//////////////////////////////////////////////////////////////////////////////////////////
+
+inline void particle_store::exchange( int i, int j )
+// exchange the particles at the indices i and j
+{
+  int           ti;
+  particle_real td;
+
+  ti = number[i]; number[i] = number[j]; number[j] = ti;
+  ti = cell[i];   cell[i]   = cell[j];   cell[j]   = ti;
+  td = x[i];      x[i]      = x[j];      x[j]      = td;
+  td = dx[i];     dx[i]     = dx[j];     dx[j]     = td;
+  td = igamma[i]; igamma[i] = igamma[j]; igamma[j] = td;
+  td = ux[i];     ux[i]     = ux[j];     ux[j]     = td;
+  td = uy[i];     uy[i]     = uy[j];     uy[j]     = td;
+  td = uz[i];     uz[i]     = uz[j];     uz[j]     = td;
+  td = w[i];      w[i]      = w[j];      w[j]      = td;
+}
+
 #endif
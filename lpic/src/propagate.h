@@ -29,9 +29,15 @@
 #include <box.h>
 #include <particle.h>
 #include <stack.h>
+#include <simd.h>
+#include <deposit.h>
+#include <scheduler.h>
 #include <diagnostic.h>
 #include <uhr.h>
 #include <readfile.h>
+#ifdef LPIC_OPENMP
+#include <omp.h>
+#endif
 
 class input_propagate {
 private:
@@ -43,6 +49,16 @@ public:
   double start_time, stop_time;
 
   int    n_domains;
+  int    overlap;                       // push the edge cells first, see propagate::edges()
+
+  int    simd;                          // vectorized push, if supported
+  int    specialize;                    // push specialized on the active field components
+  int    threads;                       // # of threads for the particle push, 0: all
+  int    tile_cells;                    // max. # of cells per tile of the threaded push
+  int    tile_particles;                // # of particles per tile
+  int    sort_interval;                 // # of time steps between two sorts, 0: never
+  int    resample;                      // # of time steps between two resamplings, 0: never
+  int    boundary;                      // box boundaries, see common.h
 
   int    Q_restart;
   char   restart_file[filename_size];
@@ -65,40 +81,115 @@ private:
     input_propagate input;
 
     stack      stk;
+    stack      edge_stk;                     // particles leaving the cells of the right edge
+    field_store &field;                      // fields of the domain, see field.h
+    current_deposit deposit;                 // current deposit into field, see deposit.h
     readfile   rf;
     double     time, start_time, stop_time;
     double     dt, dx, idx;                  // timestep and grid spacing
     double     Gamma;                        // gamma factor due to Lorentz Transformation
     int        domain_number;                // domain number
     int        n_domains;                    // # of domains
+    int        overlap;                      // overlap the halo exchange, see edges()
+    struct cell *inner, *inner_end;          // interior cells still to push, see edges()
+    int        simd;                         // instruction set of the push, see simd.h
+    int        components;                   // active field components, see select_components()
+    int        density;                      // deposit charge and densities in this step ?
+    int        density_steps, steps;         // # of steps with deposition, # of steps
+    int        current;                      // do diagnostics read the currents in this step ?
+    int        time_step;                    // # of this time step, see pushed()
+    int        cycling;                      // species of the current subcycle() or -1
+    double     step;                         // displacement at speed c in one push
+    int        cleared;                      // currents already zeroed by fields() ?
+    int        sort_interval;                // # of time steps between two sorts, 0: never
+    int        sort_pending;                 // sorted before the current push ?
+    int        push_steps;                   // # of pushes since the last sort
+    double     push_sum;                     // their cpu time
+    double     push_before;                  // cpu time per push before the last sort
+    double     sort_cpu;                     // cpu time of the last sort
+    char       sort_name[filename_size];     // sort statistics, see sort_statistics()
+    int        resample_interval;            // # of time steps between two resamplings
+    int        n_merged, n_split;            // # of particles removed by merging, added by splitting
+    int        *resample_index;              // particles of one cell, see resample()
+    int        resample_capacity;            // allocated length of resample_index
+    int        boundary;                     // box boundaries, see reinject_particles()
+    int        n_reinjected;                 // # of particles re-injected there
+    int        threads;                      // # of threads pushing the particles
+    int        tile_cells;                   // max. # of cells per tile of the threaded push
+    int        tile_particles;               // # of particles per tile
+    int        n_tiles, max_tiles;           // # of tiles in use and allocated
+    struct cell **tile;                      // first cell of each tile, see tiles()
+    double     *tile_weight;                 // # of particles to push in each tile
+    stack      **tile_stk;                   // particles leaving their cell, for each tile
+#ifdef LPIC_OPENMP
+    scheduler  *sched;                       // deals the tiles to the threads
+#endif
 
     std::ofstream grid_file;
 
     char errname[filename_size];
 
+    void         select_components( parameter &p, domain &grid, pulse &laser_front, pulse &laser_rear );
     void                clear_grid( domain &grid );
-    void                    fields( domain &grid, pulse &laser_front, pulse &laser_rear );
+    void             frozen_species( domain &grid );
+    void                    fields( domain &grid, pulse &laser_front, pulse &laser_rear,
+				    int part );
     void                 particles( domain &grid );
+    void                     edges( domain &grid );
+    void                  interior( domain &grid );
+    void                push_range( domain &grid, struct cell *begin, struct cell *end,
+				    stack *s, int tiled );
+    void                  subcycle( domain &grid, int j, struct cell *begin,
+				    struct cell *end, stack *s, int tiled );
+    void             end_subcycles( domain &grid );
+    void                sum_fields( domain &grid );
+    inline int              pushed( particle_store *sp );
+    void            sort_particles( domain &grid );
+    void           sort_statistics( double time, double push_cpu );
+    void                  resample( domain &grid );
+    void                merge_cell( struct cell *cell, particle_store *sp );
+    void                     merge( particle_store *sp, int *index, int n );
+    void                split_cell( struct cell *cell, particle_store *sp );
+    void                push_cells( domain &grid, struct cell *begin, struct cell *end,
+				    stack *s );
+#ifdef LPIC_OPENMP
+    void                     tiles( parameter &p, domain &grid, struct cell *begin,
+				    struct cell *end );
+    void           particles_tiled( domain &grid );
+#endif
     void         reflect_particles( domain &grid );
-    inline void	        accelerate( struct cell *cell, struct particle *part );
-    inline void	      accelerate_1( struct cell *cell, struct particle *part );
-    inline void	      accelerate_2( struct cell *cell, struct particle *part );
-    inline void               move( struct particle *part );
-    inline void has_to_change_cell( struct cell *cell, struct particle *part );
+    void        reinject_particles( domain &grid );
+    void                  reinject( domain &grid, struct cell *buffer, struct cell *edge,
+				    int direction );
+    inline void	        accelerate( struct cell *cell, particle_store *sp, int i );
+    inline void	      accelerate_1( struct cell *cell, particle_store *sp, int i );
+    inline void	      accelerate_2( struct cell *cell, particle_store *sp, int i );
+    template <int FC>
+    inline void          push_cell( struct cell *cell, particle_store *sp, int first, int last,
+				    stack *s );
+    template <int FC>
+    inline void               push( struct cell *cell, particle_store *sp, int first, int n,
+			       stack *s );
+    template <int FC>
+    inline void          push_simd( struct cell *cell, particle_store *sp, int first, int n,
+				    stack *s );
+    inline void               move( particle_store *sp, int i );
+    inline void has_to_change_cell( struct cell *cell, particle_store *sp, int i, stack *s );
     inline void     do_change_cell( domain &grid );
-    inline void     deposit_charge( struct cell *cell, struct particle *part );
-    inline void    deposit_current( struct cell *cell, struct particle *part );
-    inline void       mask_current( domain &grid );
+    inline void     deposit_charge( struct cell *cell, particle_store *sp, int i );
+    template <int FC>
+    inline void    deposit_current( struct cell *cell, particle_store *sp, int i );
+#ifdef CHECK_DEPOSIT
+    template <int FC>
+    void             check_deposit( struct cell *cell, particle_store *sp, int i );
+    template <int FC>
+    void                check_simd( struct cell *cell, particle_store *sp, int first, int n,
+				    struct simd_block *b );
+#endif
     inline double             mask( int i );
-    inline void           left_one( struct cell *cell, struct particle *part );
-    inline void      left_two_left( struct cell *cell, struct particle *part );
-    inline void     left_two_right( struct cell *cell, struct particle *part );
-    inline void          right_one( struct cell *cell, struct particle *part );
-    inline void    right_two_right( struct cell *cell, struct particle *part );
-    inline void     right_two_left( struct cell *cell, struct particle *part );
-
-    inline double        weighting( struct cell *cell, struct particle *part );
-    inline double      weighting_0( struct cell *cell, struct particle *part );
+
+    inline double        weighting( struct cell *cell, particle_store *sp, int i );
+    inline double      weighting_0( struct cell *cell, particle_store *sp, int i );
 
 };
 #endif
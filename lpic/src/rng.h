@@ -0,0 +1,83 @@
+/*
+   This file is part of LPIC++, a particle-in-cell code for
+   simulating the interaction of laser light with plasma.
+
+   Copyright (C) 1994-1997 Roland Lichters
+
+   LPIC++ is free software; you can redistribute it and/or
+   modify it under the terms of the GNU General Public License
+   as published by the Free Software Foundation; either version 2
+   of the License, or (at your option) any later version.
+
+   This program is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU General Public License for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with this program; if not, write to the Free Software
+   Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA 02111-1307, USA.
+*/
+
+#ifndef RNG_H
+#define RNG_H
+
+#include <common.h>
+#include <math.h>
+
+//////////////////////////////////////////////////////////////////////////////////////////
+//
+// counter based random numbers
+//
+// the k-th number of a stream is a hash of the stream key and k, so it does not depend
+// on which other streams have been used before or in parallel; domain::init_particles()
+// keys one stream on each particle by the seed, the species, the global cell number and
+// the index of the particle in its cell, such that the initial plasma is the same for
+// any number of domains and threads
+//
+// the hash is the 64 bit finalizer of SplitMix64 (Steele, Lea, Flood 2014)
+//
+//////////////////////////////////////////////////////////////////////////////////////////
+
+typedef unsigned long long rng_word;
+
+class rng_stream {
+
+ private:
+  rng_word key;                 // identifies the stream
+  rng_word k;                   // # of numbers drawn from the stream
+
+  static inline rng_word mix( rng_word z )
+    {
+      z = ( z ^ ( z >> 30 ) ) * 0xbf58476d1ce4e5b9ULL;
+      z = ( z ^ ( z >> 27 ) ) * 0x94d049bb133111ebULL;
+      return z ^ ( z >> 31 );
+    }
+
+ public:
+  rng_stream( rng_word seed, rng_word a, rng_word b, rng_word c )
+    {
+      key = mix( seed + 0x9e3779b97f4a7c15ULL );
+      key = mix( key ^ ( a + 0x632be59bd9b4e019ULL ) );
+      key = mix( key ^ ( b + 0x85157af5d6a9e2a5ULL ) );
+      key = mix( key ^ ( c + 0xd6e8feb86659fd93ULL ) );
+      k   = 0;
+    }
+
+  inline double uniform( void )            // uniform in (0,1)
+    {
+      k ++;
+      return ( ( mix( key + k * 0x9e3779b97f4a7c15ULL ) >> 11 ) + 0.5 )
+	     * ( 1.0 / 9007199254740992.0 );
+    }
+
+  inline double gauss( void )              // normal distribution, Box-Muller
+    {
+      double r1 = uniform();
+      double r2 = uniform();
+
+      return sqrt( -2.0 * log( r1 ) ) * sin( 2 * PI * r2 );
+    }
+};
+
+#endif
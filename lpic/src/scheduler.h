@@ -0,0 +1,85 @@
+/*
+   This file is part of LPIC++, a particle-in-cell code for
+   simulating the interaction of laser light with plasma.
+
+   Copyright (C) 1994-1997 Roland Lichters
+
+   LPIC++ is free software; you can redistribute it and/or
+   modify it under the terms of the GNU General Public License
+   as published by the Free Software Foundation; either version 2
+   of the License, or (at your option) any later version.
+
+   This program is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU General Public License for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with this program; if not, write to the Free Software
+   Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA 02111-1307, USA.
+*/
+
+#ifndef SCHEDULER_H
+#define SCHEDULER_H
+
+#include <common.h>
+#include <fstream>
+#include <iomanip>
+#include <string.h>
+#include <error.h>
+#include <parameter.h>
+
+#ifdef LPIC_OPENMP
+#include <omp.h>
+
+//////////////////////////////////////////////////////////////////////////////////////////
+//
+// work stealing among the threads of the tiled particle push
+//
+// the tiles of one sweep are dealt to the threads in contiguous runs of about
+// equal weight (# of particles to push); each thread takes tiles from the front
+// of its own run and, once it is exhausted, steals from the back of the runs
+// of the other threads; tiles are coarse, so one lock per run is cheap enough
+//
+//////////////////////////////////////////////////////////////////////////////////////////
+
+class scheduler {
+
+ private:
+  char      errname[filename_size];
+
+  int       threads;        // # of threads
+  int       n_queue;        // # of tiles in this sweep
+  int       max_queue;
+  int       *queue;         // tile numbers in this sweep, in cell order
+  double    *weight;        // their weights
+  int       *front, *back;  // run of each thread: queue[front] ... queue[back-1]
+  omp_lock_t *lock;         // protects front and back of each run
+
+  double    *busy;          // seconds spent pushing, for each thread
+  double    *sweep_busy;    //   in this sweep
+  double    *pushed;        // # of particles pushed
+  int       *stolen;        // # of tiles stolen from other threads
+  double    sum_max;        // sum over the sweeps of the largest busy time
+  double    sum_mean;       //   and of the mean busy time
+  int       sweeps;
+
+ public:
+           scheduler( parameter &p, int threads );
+          ~scheduler();
+
+  void      clear( void );
+  void        add( int tile, double w );
+  void       deal( void );
+  int        next( int me );
+  void       done( int me, double w, double seconds );
+  void     finish( void );
+  void     report( parameter &p );
+};
+
+#endif // LPIC_OPENMP
+
+#endif
+
+
+//eof
@@ -0,0 +1,92 @@
+/*
+   This file is part of LPIC++, a particle-in-cell code for
+   simulating the interaction of laser light with plasma.
+
+   Copyright (C) 1994-1997 Roland Lichters
+
+   LPIC++ is free software; you can redistribute it and/or
+   modify it under the terms of the GNU General Public License
+   as published by the Free Software Foundation; either version 2
+   of the License, or (at your option) any later version.
+
+   This program is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU General Public License for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with this program; if not, write to the Free Software
+   Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA 02111-1307, USA.
+*/
+
+//////////////////////////////////////////////////////////////////////////////////////////
+//
+// vectorized kernels for the particle push, see simd.C
+//
+// the kernels push a block of up to PUSH_BLOCK particles of one cell:
+// field interpolation, Boris rotation and move, and the current deposition of all
+// particles: one-boundary moves as in current_deposit::left_one() and right_one(),
+// two-boundary moves in the straight-line form of current_deposit::unified(),
+// whose case only selects operands and target cells and so maps onto vector blends
+//
+// with SINGLE_PARTICLES (see common.h) the kernels work in float on twice as
+// many particles per vector, the current contributions are still summed in double
+//
+// the instruction set is chosen at run time, the scalar push in propagate.C
+// remains the reference
+//
+//////////////////////////////////////////////////////////////////////////////////////////
+
+#ifndef SIMD_H
+#define SIMD_H
+
+#include <common.h>
+#include <particle.h>
+
+#if defined(__GNUC__) && ( defined(__x86_64__) || defined(__i386__) )
+#define LPIC_SIMD_X86
+#endif
+
+#ifdef SINGLE_PARTICLES
+#define SIMD_MAX_BLOCK 16
+#else
+#define SIMD_MAX_BLOCK 8
+#endif
+
+#if PUSH_BLOCK > SIMD_MAX_BLOCK
+#error "simd kernels: PUSH_BLOCK too large"
+#endif
+
+#define SIMD_NONE   0
+#define SIMD_AVX2   1
+#define SIMD_AVX512 2
+
+struct simd_block {
+  double ex[2], ey[2], ez[2];   // fields at the left and right hand grid point
+  double by[2], bz[2];
+  double x0;                    // left hand cell boundary
+  double dx, idx;               // grid spacing, inverse grid spacing
+  double step;                  // displacement at speed c, see propagate::move()
+  double zmpidt;                // zm * PI * dt
+  double zn;                    // charge density of one particle
+  int    fix;                   // fixed species?
+  int    components;            // active field components, FIELDS_Y and/or FIELDS_Z
+
+  double jx, jy, jz;            // output: current contributions to this cell,
+  double prev_jx, prev_jy, prev_jz; //     to the previous
+  double next_jx, next_jy, next_jz; //     and to the next cell,
+  double pprev_jy, pprev_jz;    //         two-boundary moves also to the second previous
+  double nnext_jx, nnext_jy, nnext_jz; //  and to the second next cell
+};
+
+int   simd_detect( void );
+char* simd_name( int simd );
+
+void  simd_push_avx2( struct simd_block *b, int n, particle_real *x, particle_real *dx,
+		      particle_real *igamma, particle_real *ux, particle_real *uy, particle_real *uz,
+		      particle_real *w );
+void  simd_push_avx512( struct simd_block *b, int n, particle_real *x, particle_real *dx,
+			particle_real *igamma, particle_real *ux, particle_real *uy, particle_real *uz,
+			particle_real *w );
+
+#endif
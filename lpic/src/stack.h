@@ -25,30 +25,66 @@
 #include <common.h>
 #include <cell.h>
 #include <particle.h>
+#include <domain.h>
 #include <error.h>
 #include <parameter.h>
 
-typedef struct stack_member_struct {
-  struct stack_member_struct *next;
-  struct particle            *part;
-  struct cell                *new_cell;
-} stack_member;
+//////////////////////////////////////////////////////////////////////////////////////////
+//
+// the particles which have to change their cell during one time step
+//
+// for each species the store indices of these particles are collected in a
+// preallocated buffer which only grows if it runs full, so there is no heap
+// traffic in the steady state; the particles are reassigned to their new cells
+// in one go by particle_store::migrate(), see particle.C
+//
+//////////////////////////////////////////////////////////////////////////////////////////
 
 class stack {
 
  private:
   char errname[filename_size];
 
+  int  nsp;                 // # of particle species
+  int  *size;               // allocated length of index[species]
+
+  void grow( int species );
+
  public:
-                   stack( parameter &p );
-  void      put_on_stack( struct cell *new_cell, struct particle *part );
-  void remove_from_stack( stack_member *member );
-  void   insert_particle( struct cell *new_cell, struct particle *part );
+  int  *n;                  // # of particles on stack for each species
+  int  **index;             // their indices in the particle store, ascending
 
-  stack_member *zero;
-  stack_member *hole;
+                   stack( parameter &p, domain &grid, int parts=1 );
+  inline void put_on_stack( struct cell *cell, struct cell *new_cell,
+			    particle_store *store, int index );
+  void       change_cell( domain &grid );
+  void            append( stack &s );
 };
 
+//////////////////////////////////////////////////////////////////////////////////////////
+
+inline void stack::put_on_stack( struct cell *cell, struct cell *new_cell,
+				 particle_store *store, int i )
+// particles have to be put on stack in ascending order of their store indices
+{
+#ifdef DEBUG
+  static error_handler bob("stack::put_on_stack", errname);
+
+  if ( (store->x[i] < new_cell->x)  ||  (store->x[i] > new_cell->next->x) )
+    bob.error( "particle on stack for wrong cell" );
 #endif
 
+  int species = store->species;
 
+  if ( n[species] == size[species] ) grow( species );
+
+  index[species][ n[species]++ ] = i;
+  store->cell[i] = new_cell->number;
+
+  cell->np[ species ] --;
+  cell->npart         --;
+  new_cell->np[ species ] ++;
+  new_cell->npart         ++;
+}
+
+#endif
@@ -75,6 +75,7 @@ class uhr {
   void          add( void );
   void          sys( void );
   void  seconds_cpu( void );
+  double    seconds( void );
   void  seconds_sys( void );
   void      restart( void );
   void restart_save( void );